@@ -0,0 +1,235 @@
+#include "des_key_cache.h"
+#include "des.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DES_KEY_CACHE_SHARDS 16U
+#define DES_KEY_CACHE_NONE   UINT32_MAX
+
+/* Parity bits are 8, 16, ..., 64 (1-based from the MSB); PC-1 ignores them */
+static const uint64_t DES_KEY_PARITY_CLEAR = 0xFEFEFEFEFEFEFEFEULL;
+
+typedef struct {
+    uint64_t key; /* parity-normalised */
+    uint64_t subkeys[16];
+    uint32_t next; /* bucket chain */
+    uint8_t ref;   /* CLOCK reference bit */
+} des_key_cache_entry;
+
+typedef struct {
+    pthread_mutex_t lock;
+    des_key_cache_entry* entries;
+    uint32_t* buckets;
+    uint32_t bucket_mask;
+    uint32_t slots;
+    uint32_t count;
+    uint32_t hand;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} des_key_cache_shard;
+
+struct des_key_cache {
+    size_t capacity;
+    des_key_cache_shard shards[DES_KEY_CACHE_SHARDS];
+};
+
+static void des_key_cache_wipe(void* p, size_t n)
+{
+    volatile uint8_t* v = (volatile uint8_t*) p;
+    while (n--)
+        *v++ = 0;
+}
+
+/* splitmix64 finaliser: top bits pick the shard, low bits the bucket */
+static inline uint64_t des_key_cache_hash(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline des_key_cache_shard* des_key_cache_shard_for(des_key_cache* cache, uint64_t h)
+{
+    return &cache->shards[(h >> 60) & (DES_KEY_CACHE_SHARDS - 1)];
+}
+
+static uint32_t des_key_cache_find(const des_key_cache_shard* s, uint64_t key, uint64_t h)
+{
+    uint32_t idx = s->buckets[h & s->bucket_mask];
+    while (idx != DES_KEY_CACHE_NONE) {
+        if (s->entries[idx].key == key)
+            return idx;
+        idx = s->entries[idx].next;
+    }
+    return DES_KEY_CACHE_NONE;
+}
+
+static void des_key_cache_unlink(des_key_cache_shard* s, uint32_t victim)
+{
+    uint64_t h    = des_key_cache_hash(s->entries[victim].key);
+    uint32_t* pos = &s->buckets[h & s->bucket_mask];
+    while (*pos != victim)
+        pos = &s->entries[*pos].next;
+    *pos = s->entries[victim].next;
+}
+
+/* Picks a free slot, or evicts the first entry whose reference bit is clear */
+static uint32_t des_key_cache_take_slot(des_key_cache_shard* s)
+{
+    if (s->count < s->slots)
+        return s->count++;
+
+    while (s->entries[s->hand].ref) {
+        s->entries[s->hand].ref = 0;
+        s->hand                 = (s->hand + 1) % s->slots;
+    }
+    uint32_t victim = s->hand;
+    s->hand         = (s->hand + 1) % s->slots;
+
+    des_key_cache_unlink(s, victim);
+    des_key_cache_wipe(&s->entries[victim], sizeof s->entries[victim]);
+    s->evictions++;
+    return victim;
+}
+
+static void des_key_cache_reset_shard(des_key_cache_shard* s)
+{
+    if (s->entries)
+        des_key_cache_wipe(s->entries, (size_t) s->slots * sizeof *s->entries);
+    for (uint32_t i = 0; i <= s->bucket_mask; ++i)
+        s->buckets[i] = DES_KEY_CACHE_NONE;
+    s->count = 0;
+    s->hand  = 0;
+}
+
+des_key_cache* des_key_cache_create(size_t capacity)
+{
+    if (capacity == 0 || capacity > (size_t) UINT32_MAX)
+        return NULL;
+
+    des_key_cache* cache = (des_key_cache*) calloc(1, sizeof *cache);
+    if (!cache)
+        return NULL;
+
+    uint32_t slots    = (uint32_t) ((capacity + DES_KEY_CACHE_SHARDS - 1) / DES_KEY_CACHE_SHARDS);
+    uint32_t nbuckets = 1;
+    while (nbuckets < slots)
+        nbuckets <<= 1;
+    cache->capacity = (size_t) slots * DES_KEY_CACHE_SHARDS;
+
+    unsigned inited = 0;
+    for (; inited < DES_KEY_CACHE_SHARDS; ++inited) {
+        des_key_cache_shard* s = &cache->shards[inited];
+        s->slots               = slots;
+        s->bucket_mask         = nbuckets - 1;
+        s->entries             = (des_key_cache_entry*) calloc(slots, sizeof *s->entries);
+        s->buckets             = (uint32_t*) malloc(nbuckets * sizeof *s->buckets);
+        if (!s->entries || !s->buckets || pthread_mutex_init(&s->lock, NULL) != 0) {
+            free(s->entries);
+            free(s->buckets);
+            break;
+        }
+        des_key_cache_reset_shard(s);
+    }
+
+    if (inited != DES_KEY_CACHE_SHARDS) {
+        while (inited--) {
+            pthread_mutex_destroy(&cache->shards[inited].lock);
+            free(cache->shards[inited].entries);
+            free(cache->shards[inited].buckets);
+        }
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void des_key_cache_destroy(des_key_cache* cache)
+{
+    if (!cache)
+        return;
+    for (unsigned i = 0; i < DES_KEY_CACHE_SHARDS; ++i) {
+        des_key_cache_shard* s = &cache->shards[i];
+        des_key_cache_wipe(s->entries, (size_t) s->slots * sizeof *s->entries);
+        pthread_mutex_destroy(&s->lock);
+        free(s->entries);
+        free(s->buckets);
+    }
+    free(cache);
+}
+
+int des_key_cache_get(des_key_cache* cache, uint64_t key64, uint64_t subkeys[16])
+{
+    if (!cache || !subkeys)
+        return 1;
+
+    uint64_t key           = key64 & DES_KEY_PARITY_CLEAR;
+    uint64_t h             = des_key_cache_hash(key);
+    des_key_cache_shard* s = des_key_cache_shard_for(cache, h);
+
+    pthread_mutex_lock(&s->lock);
+    uint32_t idx = des_key_cache_find(s, key, h);
+    if (idx != DES_KEY_CACHE_NONE) {
+        s->entries[idx].ref = 1;
+        s->hits++;
+        memcpy(subkeys, s->entries[idx].subkeys, sizeof s->entries[idx].subkeys);
+        pthread_mutex_unlock(&s->lock);
+        return 0;
+    }
+    s->misses++;
+    pthread_mutex_unlock(&s->lock);
+
+    /* Derive outside the lock so other keys in this shard are not blocked */
+    des_key_schedule(key, subkeys);
+
+    pthread_mutex_lock(&s->lock);
+    idx = des_key_cache_find(s, key, h);
+    if (idx == DES_KEY_CACHE_NONE) {
+        idx                    = des_key_cache_take_slot(s);
+        des_key_cache_entry* e = &s->entries[idx];
+        e->key                 = key;
+        memcpy(e->subkeys, subkeys, sizeof e->subkeys);
+        e->next                        = s->buckets[h & s->bucket_mask];
+        s->buckets[h & s->bucket_mask] = idx;
+    }
+    s->entries[idx].ref = 1;
+    pthread_mutex_unlock(&s->lock);
+    return 0;
+}
+
+void des_key_cache_clear(des_key_cache* cache)
+{
+    if (!cache)
+        return;
+    for (unsigned i = 0; i < DES_KEY_CACHE_SHARDS; ++i) {
+        des_key_cache_shard* s = &cache->shards[i];
+        pthread_mutex_lock(&s->lock);
+        des_key_cache_reset_shard(s);
+        pthread_mutex_unlock(&s->lock);
+    }
+}
+
+void des_key_cache_get_stats(des_key_cache* cache, des_key_cache_stats* out)
+{
+    if (!out)
+        return;
+    memset(out, 0, sizeof *out);
+    if (!cache)
+        return;
+    out->capacity = cache->capacity;
+    for (unsigned i = 0; i < DES_KEY_CACHE_SHARDS; ++i) {
+        des_key_cache_shard* s = &cache->shards[i];
+        pthread_mutex_lock(&s->lock);
+        out->hits += s->hits;
+        out->misses += s->misses;
+        out->evictions += s->evictions;
+        out->entries += s->count;
+        pthread_mutex_unlock(&s->lock);
+    }
+}
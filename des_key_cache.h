@@ -0,0 +1,37 @@
+#ifndef DES_KEY_CACHE_H
+#define DES_KEY_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Thread-safe, bounded cache of expanded key schedules.
+   Keys are normalised by clearing the parity bits (LSB of each byte), so keys
+   that differ only in parity share one entry. Entries are spread over
+   independently locked shards and evicted with CLOCK; evicted subkeys are
+   wiped before the slot is reused. */
+typedef struct des_key_cache des_key_cache;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t capacity;
+} des_key_cache_stats;
+
+/* capacity is the total number of cached schedules (rounded up to fill every
+   shard). Returns NULL on allocation failure, capacity == 0 or
+   capacity > UINT32_MAX. */
+des_key_cache* des_key_cache_create(size_t capacity);
+void des_key_cache_destroy(des_key_cache* cache);
+
+/* Copies the 16 subkeys for key64 into subkeys, deriving them on a miss.
+   Returns 0 on success, 1 on invalid arguments. */
+int des_key_cache_get(des_key_cache* cache, uint64_t key64, uint64_t subkeys[16]);
+
+/* Wipes and drops every cached schedule; statistics are kept. */
+void des_key_cache_clear(des_key_cache* cache);
+
+void des_key_cache_get_stats(des_key_cache* cache, des_key_cache_stats* out);
+
+#endif /* DES_KEY_CACHE_H */
@@ -64,6 +64,137 @@ const uint8_t DES_S8[64]        = {13, 2,  8,  4, 6,  15, 11, 1,  10, 9,  3,  14
                                    7,  11, 4,  1, 9,  12, 14, 2,  0,  6,  10, 13, 15, 3,  5,  8,
                                    2,  1,  14, 7, 4,  10, 8,  13, 15, 12, 9,  0,  3,  5,  6,  11};
 
+/* S-boxes merged with P, indexed by the raw 6-bit S-box input:
+   DES_SP[i][six] = P(S(i+1)[row, col] << (28 - 4 * i)) */
+const uint32_t DES_SP[8][64]    = {{0x00808200U, 0x00000000U, 0x00008000U, 0x00808202U,
+                                    0x00808002U, 0x00008202U, 0x00000002U, 0x00008000U,
+                                    0x00000200U, 0x00808200U, 0x00808202U, 0x00000200U,
+                                    0x00800202U, 0x00808002U, 0x00800000U, 0x00000002U,
+                                    0x00000202U, 0x00800200U, 0x00800200U, 0x00008200U,
+                                    0x00008200U, 0x00808000U, 0x00808000U, 0x00800202U,
+                                    0x00008002U, 0x00800002U, 0x00800002U, 0x00008002U,
+                                    0x00000000U, 0x00000202U, 0x00008202U, 0x00800000U,
+                                    0x00008000U, 0x00808202U, 0x00000002U, 0x00808000U,
+                                    0x00808200U, 0x00800000U, 0x00800000U, 0x00000200U,
+                                    0x00808002U, 0x00008000U, 0x00008200U, 0x00800002U,
+                                    0x00000200U, 0x00000002U, 0x00800202U, 0x00008202U,
+                                    0x00808202U, 0x00008002U, 0x00808000U, 0x00800202U,
+                                    0x00800002U, 0x00000202U, 0x00008202U, 0x00808200U,
+                                    0x00000202U, 0x00800200U, 0x00800200U, 0x00000000U,
+                                    0x00008002U, 0x00008200U, 0x00000000U, 0x00808002U},
+                                   {0x40084010U, 0x40004000U, 0x00004000U, 0x00084010U,
+                                    0x00080000U, 0x00000010U, 0x40080010U, 0x40004010U,
+                                    0x40000010U, 0x40084010U, 0x40084000U, 0x40000000U,
+                                    0x40004000U, 0x00080000U, 0x00000010U, 0x40080010U,
+                                    0x00084000U, 0x00080010U, 0x40004010U, 0x00000000U,
+                                    0x40000000U, 0x00004000U, 0x00084010U, 0x40080000U,
+                                    0x00080010U, 0x40000010U, 0x00000000U, 0x00084000U,
+                                    0x00004010U, 0x40084000U, 0x40080000U, 0x00004010U,
+                                    0x00000000U, 0x00084010U, 0x40080010U, 0x00080000U,
+                                    0x40004010U, 0x40080000U, 0x40084000U, 0x00004000U,
+                                    0x40080000U, 0x40004000U, 0x00000010U, 0x40084010U,
+                                    0x00084010U, 0x00000010U, 0x00004000U, 0x40000000U,
+                                    0x00004010U, 0x40084000U, 0x00080000U, 0x40000010U,
+                                    0x00080010U, 0x40004010U, 0x40000010U, 0x00080010U,
+                                    0x00084000U, 0x00000000U, 0x40004000U, 0x00004010U,
+                                    0x40000000U, 0x40080010U, 0x40084010U, 0x00084000U},
+                                   {0x00000104U, 0x04010100U, 0x00000000U, 0x04010004U,
+                                    0x04000100U, 0x00000000U, 0x00010104U, 0x04000100U,
+                                    0x00010004U, 0x04000004U, 0x04000004U, 0x00010000U,
+                                    0x04010104U, 0x00010004U, 0x04010000U, 0x00000104U,
+                                    0x04000000U, 0x00000004U, 0x04010100U, 0x00000100U,
+                                    0x00010100U, 0x04010000U, 0x04010004U, 0x00010104U,
+                                    0x04000104U, 0x00010100U, 0x00010000U, 0x04000104U,
+                                    0x00000004U, 0x04010104U, 0x00000100U, 0x04000000U,
+                                    0x04010100U, 0x04000000U, 0x00010004U, 0x00000104U,
+                                    0x00010000U, 0x04010100U, 0x04000100U, 0x00000000U,
+                                    0x00000100U, 0x00010004U, 0x04010104U, 0x04000100U,
+                                    0x04000004U, 0x00000100U, 0x00000000U, 0x04010004U,
+                                    0x04000104U, 0x00010000U, 0x04000000U, 0x04010104U,
+                                    0x00000004U, 0x00010104U, 0x00010100U, 0x04000004U,
+                                    0x04010000U, 0x04000104U, 0x00000104U, 0x04010000U,
+                                    0x00010104U, 0x00000004U, 0x04010004U, 0x00010100U},
+                                   {0x80401000U, 0x80001040U, 0x80001040U, 0x00000040U,
+                                    0x00401040U, 0x80400040U, 0x80400000U, 0x80001000U,
+                                    0x00000000U, 0x00401000U, 0x00401000U, 0x80401040U,
+                                    0x80000040U, 0x00000000U, 0x00400040U, 0x80400000U,
+                                    0x80000000U, 0x00001000U, 0x00400000U, 0x80401000U,
+                                    0x00000040U, 0x00400000U, 0x80001000U, 0x00001040U,
+                                    0x80400040U, 0x80000000U, 0x00001040U, 0x00400040U,
+                                    0x00001000U, 0x00401040U, 0x80401040U, 0x80000040U,
+                                    0x00400040U, 0x80400000U, 0x00401000U, 0x80401040U,
+                                    0x80000040U, 0x00000000U, 0x00000000U, 0x00401000U,
+                                    0x00001040U, 0x00400040U, 0x80400040U, 0x80000000U,
+                                    0x80401000U, 0x80001040U, 0x80001040U, 0x00000040U,
+                                    0x80401040U, 0x80000040U, 0x80000000U, 0x00001000U,
+                                    0x80400000U, 0x80001000U, 0x00401040U, 0x80400040U,
+                                    0x80001000U, 0x00001040U, 0x00400000U, 0x80401000U,
+                                    0x00000040U, 0x00400000U, 0x00001000U, 0x00401040U},
+                                   {0x00000080U, 0x01040080U, 0x01040000U, 0x21000080U,
+                                    0x00040000U, 0x00000080U, 0x20000000U, 0x01040000U,
+                                    0x20040080U, 0x00040000U, 0x01000080U, 0x20040080U,
+                                    0x21000080U, 0x21040000U, 0x00040080U, 0x20000000U,
+                                    0x01000000U, 0x20040000U, 0x20040000U, 0x00000000U,
+                                    0x20000080U, 0x21040080U, 0x21040080U, 0x01000080U,
+                                    0x21040000U, 0x20000080U, 0x00000000U, 0x21000000U,
+                                    0x01040080U, 0x01000000U, 0x21000000U, 0x00040080U,
+                                    0x00040000U, 0x21000080U, 0x00000080U, 0x01000000U,
+                                    0x20000000U, 0x01040000U, 0x21000080U, 0x20040080U,
+                                    0x01000080U, 0x20000000U, 0x21040000U, 0x01040080U,
+                                    0x20040080U, 0x00000080U, 0x01000000U, 0x21040000U,
+                                    0x21040080U, 0x00040080U, 0x21000000U, 0x21040080U,
+                                    0x01040000U, 0x00000000U, 0x20040000U, 0x21000000U,
+                                    0x00040080U, 0x01000080U, 0x20000080U, 0x00040000U,
+                                    0x00000000U, 0x20040000U, 0x01040080U, 0x20000080U},
+                                   {0x10000008U, 0x10200000U, 0x00002000U, 0x10202008U,
+                                    0x10200000U, 0x00000008U, 0x10202008U, 0x00200000U,
+                                    0x10002000U, 0x00202008U, 0x00200000U, 0x10000008U,
+                                    0x00200008U, 0x10002000U, 0x10000000U, 0x00002008U,
+                                    0x00000000U, 0x00200008U, 0x10002008U, 0x00002000U,
+                                    0x00202000U, 0x10002008U, 0x00000008U, 0x10200008U,
+                                    0x10200008U, 0x00000000U, 0x00202008U, 0x10202000U,
+                                    0x00002008U, 0x00202000U, 0x10202000U, 0x10000000U,
+                                    0x10002000U, 0x00000008U, 0x10200008U, 0x00202000U,
+                                    0x10202008U, 0x00200000U, 0x00002008U, 0x10000008U,
+                                    0x00200000U, 0x10002000U, 0x10000000U, 0x00002008U,
+                                    0x10000008U, 0x10202008U, 0x00202000U, 0x10200000U,
+                                    0x00202008U, 0x10202000U, 0x00000000U, 0x10200008U,
+                                    0x00000008U, 0x00002000U, 0x10200000U, 0x00202008U,
+                                    0x00002000U, 0x00200008U, 0x10002008U, 0x00000000U,
+                                    0x10202000U, 0x10000000U, 0x00200008U, 0x10002008U},
+                                   {0x00100000U, 0x02100001U, 0x02000401U, 0x00000000U,
+                                    0x00000400U, 0x02000401U, 0x00100401U, 0x02100400U,
+                                    0x02100401U, 0x00100000U, 0x00000000U, 0x02000001U,
+                                    0x00000001U, 0x02000000U, 0x02100001U, 0x00000401U,
+                                    0x02000400U, 0x00100401U, 0x00100001U, 0x02000400U,
+                                    0x02000001U, 0x02100000U, 0x02100400U, 0x00100001U,
+                                    0x02100000U, 0x00000400U, 0x00000401U, 0x02100401U,
+                                    0x00100400U, 0x00000001U, 0x02000000U, 0x00100400U,
+                                    0x02000000U, 0x00100400U, 0x00100000U, 0x02000401U,
+                                    0x02000401U, 0x02100001U, 0x02100001U, 0x00000001U,
+                                    0x00100001U, 0x02000000U, 0x02000400U, 0x00100000U,
+                                    0x02100400U, 0x00000401U, 0x00100401U, 0x02100400U,
+                                    0x00000401U, 0x02000001U, 0x02100401U, 0x02100000U,
+                                    0x00100400U, 0x00000000U, 0x00000001U, 0x02100401U,
+                                    0x00000000U, 0x00100401U, 0x02100000U, 0x00000400U,
+                                    0x02000001U, 0x02000400U, 0x00000400U, 0x00100001U},
+                                   {0x08000820U, 0x00000800U, 0x00020000U, 0x08020820U,
+                                    0x08000000U, 0x08000820U, 0x00000020U, 0x08000000U,
+                                    0x00020020U, 0x08020000U, 0x08020820U, 0x00020800U,
+                                    0x08020800U, 0x00020820U, 0x00000800U, 0x00000020U,
+                                    0x08020000U, 0x08000020U, 0x08000800U, 0x00000820U,
+                                    0x00020800U, 0x00020020U, 0x08020020U, 0x08020800U,
+                                    0x00000820U, 0x00000000U, 0x00000000U, 0x08020020U,
+                                    0x08000020U, 0x08000800U, 0x00020820U, 0x00020000U,
+                                    0x00020820U, 0x00020000U, 0x08020800U, 0x00000800U,
+                                    0x00000020U, 0x08020020U, 0x00000800U, 0x00020820U,
+                                    0x08000800U, 0x00000020U, 0x08000020U, 0x08020000U,
+                                    0x08020020U, 0x08000000U, 0x00020000U, 0x08000820U,
+                                    0x00000000U, 0x08020820U, 0x00020020U, 0x08000020U,
+                                    0x08020000U, 0x08000800U, 0x08000820U, 0x00000000U,
+                                    0x08020820U, 0x00020800U, 0x00020800U, 0x00000820U,
+                                    0x00000820U, 0x00020020U, 0x08000000U, 0x08020800U}};
+
 const uint8_t DES_PC1[56]       = {57, 49, 41, 33, 25, 17, 9,  1,  58, 50, 42, 34, 26, 18,
                                    10, 2,  59, 51, 43, 35, 27, 19, 11, 3,  60, 52, 44, 36,
                                    63, 55, 47, 39, 31, 23, 15, 7,  62, 54, 46, 38, 30, 22,
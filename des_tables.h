@@ -20,6 +20,8 @@ extern const uint8_t DES_S6[64];
 extern const uint8_t DES_S7[64];
 extern const uint8_t DES_S8[64];
 
+extern const uint32_t DES_SP[8][64];
+
 extern const uint8_t DES_PC1[56];
 extern const uint8_t DES_PC2[48];
 extern const uint8_t DES_ROTATIONS[16];